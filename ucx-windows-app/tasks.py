@@ -66,6 +66,12 @@ def build(c, clean=False):
     _build_target(c, target='ucx-windows-app', clean=clean)
 
 
+@task(help={'clean': 'Clean build directory before building'})
+def bench(c, clean=False):
+    """Build ucx-windows-app-bench (hardware-free benchmark on recorded UART traces)."""
+    _build_target(c, target='ucx-windows-app-bench', clean=clean)
+
+
 @task
 def clean(c):
     """Clean all build artifacts."""
@@ -82,4 +88,5 @@ def clean(c):
 # Create namespace
 ns = Collection()
 ns.add_task(build)
+ns.add_task(bench)
 ns.add_task(clean)
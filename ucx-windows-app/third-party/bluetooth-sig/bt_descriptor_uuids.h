@@ -8,6 +8,7 @@
 #ifndef BT_DESCRIPTOR_UUIDS_H
 #define BT_DESCRIPTOR_UUIDS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -44,13 +45,27 @@ static const BtDescriptor_t BT_DESCRIPTORS[] = {
 
 #define BT_DESCRIPTORS_COUNT 24
 
-static inline const char* btGetDescriptorName(uint16_t uuid) {
-    for (int i = 0; i < BT_DESCRIPTORS_COUNT; i++) {
-        if (BT_DESCRIPTORS[i].uuid == uuid) {
-            return BT_DESCRIPTORS[i].name;
-        }
+/* Direct index: BT_DESCRIPTORS_INDEX[key - BT_DESCRIPTORS_MIN] = entry position + 1, 0 = unassigned */
+#define BT_DESCRIPTORS_MIN 10496
+#define BT_DESCRIPTORS_SPAN 24
+
+static const uint16_t BT_DESCRIPTORS_INDEX[BT_DESCRIPTORS_SPAN] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24,
+};
+
+static inline const BtDescriptor_t* btFindDescriptor(uint16_t uuid) {
+    uint32_t offset = (uint32_t)uuid - BT_DESCRIPTORS_MIN;
+    if (offset >= BT_DESCRIPTORS_SPAN) {
+        return NULL;
     }
-    return NULL;
+    uint16_t pos = BT_DESCRIPTORS_INDEX[offset];
+    return pos ? &BT_DESCRIPTORS[pos - 1] : NULL;
+}
+
+static inline const char* btGetDescriptorName(uint16_t uuid) {
+    const BtDescriptor_t *entry = btFindDescriptor(uuid);
+    return entry ? entry->name : NULL;
 }
 
 #endif /* BT_DESCRIPTOR_UUIDS_H */
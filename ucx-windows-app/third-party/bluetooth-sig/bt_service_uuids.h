@@ -8,6 +8,7 @@
 #ifndef BT_SERVICE_UUIDS_H
 #define BT_SERVICE_UUIDS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -93,13 +94,31 @@ static const BtService_t BT_SERVICES[] = {
 
 #define BT_SERVICES_COUNT 73
 
-static inline const char* btGetServiceName(uint16_t uuid) {
-    for (int i = 0; i < BT_SERVICES_COUNT; i++) {
-        if (BT_SERVICES[i].uuid == uuid) {
-            return BT_SERVICES[i].name;
-        }
+/* Direct index: BT_SERVICES_INDEX[key - BT_SERVICES_MIN] = entry position + 1, 0 = unassigned */
+#define BT_SERVICES_MIN 6144
+#define BT_SERVICES_SPAN 94
+
+static const uint16_t BT_SERVICES_INDEX[BT_SERVICES_SPAN] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 0, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 43, 44, 45,
+    46, 0, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+};
+
+static inline const BtService_t* btFindService(uint16_t uuid) {
+    uint32_t offset = (uint32_t)uuid - BT_SERVICES_MIN;
+    if (offset >= BT_SERVICES_SPAN) {
+        return NULL;
     }
-    return NULL;
+    uint16_t pos = BT_SERVICES_INDEX[offset];
+    return pos ? &BT_SERVICES[pos - 1] : NULL;
+}
+
+static inline const char* btGetServiceName(uint16_t uuid) {
+    const BtService_t *entry = btFindService(uuid);
+    return entry ? entry->name : NULL;
 }
 
 #endif /* BT_SERVICE_UUIDS_H */
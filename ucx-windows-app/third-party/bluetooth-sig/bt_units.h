@@ -8,6 +8,7 @@
 #ifndef BT_UNITS_H
 #define BT_UNITS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -148,22 +149,43 @@ static const BtUnit_t BT_UNITS[] = {
 
 #define BT_UNITS_COUNT 127
 
-static inline const char* btGetUnitName(uint16_t uuid) {
-    for (int i = 0; i < BT_UNITS_COUNT; i++) {
-        if (BT_UNITS[i].uuid == uuid) {
-            return BT_UNITS[i].name;
-        }
+/* Direct index: BT_UNITS_INDEX[key - BT_UNITS_MIN] = entry position + 1, 0 = unassigned */
+#define BT_UNITS_MIN 9984
+#define BT_UNITS_SPAN 202
+
+static const uint16_t BT_UNITS_INDEX[BT_UNITS_SPAN] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+    62, 63, 64, 65, 66, 67, 68, 69, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    79, 80, 81, 82, 83, 84, 85, 86, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+    103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 0, 114, 115, 116, 117,
+    118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+};
+
+static inline const BtUnit_t* btFindUnit(uint16_t uuid) {
+    uint32_t offset = (uint32_t)uuid - BT_UNITS_MIN;
+    if (offset >= BT_UNITS_SPAN) {
+        return NULL;
     }
-    return NULL;
+    uint16_t pos = BT_UNITS_INDEX[offset];
+    return pos ? &BT_UNITS[pos - 1] : NULL;
+}
+
+static inline const char* btGetUnitName(uint16_t uuid) {
+    const BtUnit_t *entry = btFindUnit(uuid);
+    return entry ? entry->name : NULL;
 }
 
 static inline const char* btGetUnitSymbol(uint16_t uuid) {
-    for (int i = 0; i < BT_UNITS_COUNT; i++) {
-        if (BT_UNITS[i].uuid == uuid) {
-            return BT_UNITS[i].symbol;
-        }
-    }
-    return NULL;
+    const BtUnit_t *entry = btFindUnit(uuid);
+    return entry ? entry->symbol : NULL;
 }
 
 #endif /* BT_UNITS_H */
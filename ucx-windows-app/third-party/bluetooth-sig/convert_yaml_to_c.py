@@ -1,12 +1,98 @@
 #!/usr/bin/env python3
 """
 Convert Bluetooth SIG YAML files to C header files with lookup tables.
+
+Every table gets an O(1) index next to the entry array:
+  - Direct index when the key range is dense (span <= DIRECT_INDEX_MAX_RATIO * count):
+    INDEX[key - MIN] holds the entry position + 1 (0 = unassigned).
+  - Paged index otherwise (e.g. appearance values, category << 6 | subcategory):
+    keys are split in pages of 2^PAGE_SHIFT, each page only stores slots up to its
+    highest assigned key.
+
+After generating, the headers are parsed back and every lookup is checked against
+the YAML sources. Run with --check to only verify the existing headers.
 """
 
+import re
 import yaml
 import sys
 from pathlib import Path
 
+DIRECT_INDEX_MAX_RATIO = 4
+PAGE_SHIFT = 6
+
+def write_c_array(f, c_type, name, size_expr, values, per_line=16):
+    """Write a constant C array, per_line values per row."""
+    f.write(f"static const {c_type} {name}[{size_expr}] = {{\n")
+    for i in range(0, len(values), per_line):
+        row = ", ".join(str(v) for v in values[i:i + per_line])
+        f.write(f"    {row},\n")
+    f.write("};\n\n")
+
+def write_index(f, prefix, keys):
+    """Write the O(1) index for an entry array whose keys are given in array order."""
+    lo = min(keys)
+    hi = max(keys)
+    span = hi - lo + 1
+    
+    if span <= DIRECT_INDEX_MAX_RATIO * len(keys):
+        index = [0] * span
+        for pos, key in enumerate(keys):
+            index[key - lo] = pos + 1
+        f.write(f"/* Direct index: {prefix}_INDEX[key - {prefix}_MIN] = entry position + 1, 0 = unassigned */\n")
+        f.write(f"#define {prefix}_MIN {lo}\n")
+        f.write(f"#define {prefix}_SPAN {span}\n\n")
+        write_c_array(f, "uint16_t", f"{prefix}_INDEX", f"{prefix}_SPAN", index)
+        return
+    
+    page_size = 1 << PAGE_SHIFT
+    pages = ((hi - lo) >> PAGE_SHIFT) + 1
+    page_len = [0] * pages
+    for key in keys:
+        page = (key - lo) >> PAGE_SHIFT
+        slot = (key - lo) & (page_size - 1)
+        page_len[page] = max(page_len[page], slot + 1)
+    page_base = []
+    total = 0
+    for length in page_len:
+        page_base.append(total)
+        total += length
+    slots = [0] * total
+    for pos, key in enumerate(keys):
+        page = (key - lo) >> PAGE_SHIFT
+        slot = (key - lo) & (page_size - 1)
+        slots[page_base[page] + slot] = pos + 1
+    
+    f.write(f"/* Paged index: page = (key - {prefix}_MIN) >> {PAGE_SHIFT}, entry position + 1 in\n")
+    f.write(f" * {prefix}_SLOTS[{prefix}_PAGE_BASE[page] + slot], 0 = unassigned */\n")
+    f.write(f"#define {prefix}_MIN {lo}\n")
+    f.write(f"#define {prefix}_PAGE_SHIFT {PAGE_SHIFT}\n")
+    f.write(f"#define {prefix}_PAGES {pages}\n")
+    f.write(f"#define {prefix}_SLOT_COUNT {total}\n\n")
+    write_c_array(f, "uint16_t", f"{prefix}_PAGE_BASE", f"{prefix}_PAGES", page_base)
+    write_c_array(f, "uint8_t", f"{prefix}_PAGE_LEN", f"{prefix}_PAGES", page_len)
+    write_c_array(f, "uint16_t", f"{prefix}_SLOTS", f"{prefix}_SLOT_COUNT", slots)
+
+def write_find_function(f, prefix, keys, entry_type, array_name, func_name, param):
+    """Write the O(1) find function matching the index emitted by write_index()."""
+    span = max(keys) - min(keys) + 1
+    f.write(f"static inline const {entry_type}* {func_name}(uint16_t {param}) {{\n")
+    f.write(f"    uint32_t offset = (uint32_t){param} - {prefix}_MIN;\n")
+    if span <= DIRECT_INDEX_MAX_RATIO * len(keys):
+        f.write(f"    if (offset >= {prefix}_SPAN) {{\n")
+        f.write(f"        return NULL;\n")
+        f.write(f"    }}\n")
+        f.write(f"    uint16_t pos = {prefix}_INDEX[offset];\n")
+    else:
+        f.write(f"    uint32_t page = offset >> {prefix}_PAGE_SHIFT;\n")
+        f.write(f"    uint32_t slot = offset & ((1u << {prefix}_PAGE_SHIFT) - 1);\n")
+        f.write(f"    if (page >= {prefix}_PAGES || slot >= {prefix}_PAGE_LEN[page]) {{\n")
+        f.write(f"        return NULL;\n")
+        f.write(f"    }}\n")
+        f.write(f"    uint16_t pos = {prefix}_SLOTS[{prefix}_PAGE_BASE[page] + slot];\n")
+    f.write(f"    return pos ? &{array_name}[pos - 1] : NULL;\n")
+    f.write(f"}}\n\n")
+
 def convert_company_identifiers(yaml_file, output_file):
     """Convert company_identifiers.yaml to C header."""
     
@@ -26,6 +112,7 @@ def convert_company_identifiers(yaml_file, output_file):
 #ifndef BT_COMPANY_IDENTIFIERS_H
 #define BT_COMPANY_IDENTIFIERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -44,14 +131,14 @@ static const BtCompany_t BT_COMPANIES[] = {
         f.write(f"""}};\n
 #define BT_COMPANIES_COUNT {len(companies)}
 
-static inline const char* btGetCompanyName(uint16_t companyId) {{
-    for (int i = 0; i < BT_COMPANIES_COUNT; i++) {{
-        if (BT_COMPANIES[i].id == companyId) {{
-            return BT_COMPANIES[i].name;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [company['value'] for company in companies]
+        write_index(f, "BT_COMPANIES", keys)
+        write_find_function(f, "BT_COMPANIES", keys, "BtCompany_t", "BT_COMPANIES", "btFindCompany", "companyId")
+        f.write("""static inline const char* btGetCompanyName(uint16_t companyId) {
+    const BtCompany_t *entry = btFindCompany(companyId);
+    return entry ? entry->name : NULL;
+}
 
 #endif /* BT_COMPANY_IDENTIFIERS_H */
 """)
@@ -77,6 +164,7 @@ def convert_service_uuids(yaml_file, output_file):
 #ifndef BT_SERVICE_UUIDS_H
 #define BT_SERVICE_UUIDS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -95,14 +183,14 @@ static const BtService_t BT_SERVICES[] = {
         f.write(f"""}};\n
 #define BT_SERVICES_COUNT {len(services)}
 
-static inline const char* btGetServiceName(uint16_t uuid) {{
-    for (int i = 0; i < BT_SERVICES_COUNT; i++) {{
-        if (BT_SERVICES[i].uuid == uuid) {{
-            return BT_SERVICES[i].name;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [service['uuid'] for service in services]
+        write_index(f, "BT_SERVICES", keys)
+        write_find_function(f, "BT_SERVICES", keys, "BtService_t", "BT_SERVICES", "btFindService", "uuid")
+        f.write("""static inline const char* btGetServiceName(uint16_t uuid) {
+    const BtService_t *entry = btFindService(uuid);
+    return entry ? entry->name : NULL;
+}
 
 #endif /* BT_SERVICE_UUIDS_H */
 """)
@@ -147,6 +235,7 @@ def convert_appearance_values(yaml_file, output_file):
 #ifndef BT_APPEARANCE_VALUES_H
 #define BT_APPEARANCE_VALUES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -164,14 +253,14 @@ static const BtAppearance_t BT_APPEARANCES[] = {
         f.write(f"""}};\n
 #define BT_APPEARANCES_COUNT {len(appearance_list)}
 
-static inline const char* btGetAppearanceName(uint16_t appearance) {{
-    for (int i = 0; i < BT_APPEARANCES_COUNT; i++) {{
-        if (BT_APPEARANCES[i].value == appearance) {{
-            return BT_APPEARANCES[i].name;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [value for value, _ in appearance_list]
+        write_index(f, "BT_APPEARANCES", keys)
+        write_find_function(f, "BT_APPEARANCES", keys, "BtAppearance_t", "BT_APPEARANCES", "btFindAppearance", "appearance")
+        f.write("""static inline const char* btGetAppearanceName(uint16_t appearance) {
+    const BtAppearance_t *entry = btFindAppearance(appearance);
+    return entry ? entry->name : NULL;
+}
 
 #endif /* BT_APPEARANCE_VALUES_H */
 """)
@@ -197,6 +286,7 @@ def convert_characteristic_uuids(yaml_file, output_file):
 #ifndef BT_CHARACTERISTIC_UUIDS_H
 #define BT_CHARACTERISTIC_UUIDS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -215,14 +305,14 @@ static const BtCharacteristic_t BT_CHARACTERISTICS[] = {
         f.write(f"""}};\n
 #define BT_CHARACTERISTICS_COUNT {len(characteristics)}
 
-static inline const char* btGetCharacteristicName(uint16_t uuid) {{
-    for (int i = 0; i < BT_CHARACTERISTICS_COUNT; i++) {{
-        if (BT_CHARACTERISTICS[i].uuid == uuid) {{
-            return BT_CHARACTERISTICS[i].name;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [char['uuid'] for char in characteristics]
+        write_index(f, "BT_CHARACTERISTICS", keys)
+        write_find_function(f, "BT_CHARACTERISTICS", keys, "BtCharacteristic_t", "BT_CHARACTERISTICS", "btFindCharacteristic", "uuid")
+        f.write("""static inline const char* btGetCharacteristicName(uint16_t uuid) {
+    const BtCharacteristic_t *entry = btFindCharacteristic(uuid);
+    return entry ? entry->name : NULL;
+}
 
 #endif /* BT_CHARACTERISTIC_UUIDS_H */
 """)
@@ -248,6 +338,7 @@ def convert_descriptor_uuids(yaml_file, output_file):
 #ifndef BT_DESCRIPTOR_UUIDS_H
 #define BT_DESCRIPTOR_UUIDS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -266,14 +357,14 @@ static const BtDescriptor_t BT_DESCRIPTORS[] = {
         f.write(f"""}};\n
 #define BT_DESCRIPTORS_COUNT {len(descriptors)}
 
-static inline const char* btGetDescriptorName(uint16_t uuid) {{
-    for (int i = 0; i < BT_DESCRIPTORS_COUNT; i++) {{
-        if (BT_DESCRIPTORS[i].uuid == uuid) {{
-            return BT_DESCRIPTORS[i].name;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [desc['uuid'] for desc in descriptors]
+        write_index(f, "BT_DESCRIPTORS", keys)
+        write_find_function(f, "BT_DESCRIPTORS", keys, "BtDescriptor_t", "BT_DESCRIPTORS", "btFindDescriptor", "uuid")
+        f.write("""static inline const char* btGetDescriptorName(uint16_t uuid) {
+    const BtDescriptor_t *entry = btFindDescriptor(uuid);
+    return entry ? entry->name : NULL;
+}
 
 #endif /* BT_DESCRIPTOR_UUIDS_H */
 """)
@@ -299,6 +390,7 @@ def convert_units(yaml_file, output_file):
 #ifndef BT_UNITS_H
 #define BT_UNITS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -372,32 +464,146 @@ static const BtUnit_t BT_UNITS[] = {
         f.write(f"""}};\n
 #define BT_UNITS_COUNT {len(units)}
 
-static inline const char* btGetUnitName(uint16_t uuid) {{
-    for (int i = 0; i < BT_UNITS_COUNT; i++) {{
-        if (BT_UNITS[i].uuid == uuid) {{
-            return BT_UNITS[i].name;
-        }}
-    }}
-    return NULL;
-}}
-
-static inline const char* btGetUnitSymbol(uint16_t uuid) {{
-    for (int i = 0; i < BT_UNITS_COUNT; i++) {{
-        if (BT_UNITS[i].uuid == uuid) {{
-            return BT_UNITS[i].symbol;
-        }}
-    }}
-    return NULL;
-}}
+""")
+        keys = [unit['uuid'] for unit in units]
+        write_index(f, "BT_UNITS", keys)
+        write_find_function(f, "BT_UNITS", keys, "BtUnit_t", "BT_UNITS", "btFindUnit", "uuid")
+        f.write("""static inline const char* btGetUnitName(uint16_t uuid) {
+    const BtUnit_t *entry = btFindUnit(uuid);
+    return entry ? entry->name : NULL;
+}
+
+static inline const char* btGetUnitSymbol(uint16_t uuid) {
+    const BtUnit_t *entry = btFindUnit(uuid);
+    return entry ? entry->symbol : NULL;
+}
 
 #endif /* BT_UNITS_H */
 """)
     
     print(f"Generated {output_file} with {len(units)} units")
 
+def load_yaml_entries(yaml_file, list_key, key_field):
+    """Load (key, name) pairs from a flat SIG YAML list."""
+    with open(yaml_file, 'r', encoding='utf-8') as f:
+        data = yaml.safe_load(f)
+    return [(entry[key_field], entry['name']) for entry in data[list_key]]
+
+def load_yaml_appearances(yaml_file):
+    """Load (appearance value, name) pairs, flattening categories and subcategories."""
+    with open(yaml_file, 'r', encoding='utf-8') as f:
+        data = yaml.safe_load(f)
+    entries = []
+    for category_entry in data['appearance_values']:
+        category = category_entry['category']
+        entries.append((category << 6, category_entry['name']))
+        for subcat in category_entry.get('subcategory', []):
+            entries.append(((category << 6) | subcat['value'], subcat['name']))
+    return entries
+
+def parse_c_array(text, name):
+    """Return the numeric values of a generated index array."""
+    match = re.search(r'static const uint(?:8|16)_t ' + name + r'\[[^\]]*\] = \{(.*?)\};', text, re.S)
+    if not match:
+        return None
+    return [int(v) for v in re.findall(r'\d+', match.group(1))]
+
+def parse_c_define(text, name):
+    match = re.search(r'#define ' + name + r' (\d+)', text)
+    return int(match.group(1)) if match else None
+
+def check_header(header_file, prefix, yaml_entries):
+    """Parse a generated header back and verify every 16-bit key against the YAML.
+    
+    Returns a list of error strings (empty on success).
+    """
+    text = header_file.read_text(encoding='utf-8')
+    errors = []
+    
+    # Entry array: {key, "name"...}
+    array = re.search(r'static const \w+ ' + prefix + r'\[\] = \{(.*?)\n\};', text, re.S)
+    if not array:
+        return [f"{header_file.name}: {prefix}[] not found"]
+    entries = [(int(key, 0), name.replace('\\"', '"'))
+               for key, name in re.findall(r'\{(0x[0-9A-Fa-f]+|\d+), "((?:[^"\\]|\\.)*)"', array.group(1))]
+    
+    lo = parse_c_define(text, prefix + '_MIN')
+    span = parse_c_define(text, prefix + '_SPAN')
+    if span is not None:
+        index = parse_c_array(text, prefix + '_INDEX')
+        def lookup(key):
+            offset = key - lo
+            if offset < 0 or offset >= span:
+                return 0
+            return index[offset]
+    else:
+        shift = parse_c_define(text, prefix + '_PAGE_SHIFT')
+        pages = parse_c_define(text, prefix + '_PAGES')
+        page_base = parse_c_array(text, prefix + '_PAGE_BASE')
+        page_len = parse_c_array(text, prefix + '_PAGE_LEN')
+        slots = parse_c_array(text, prefix + '_SLOTS')
+        def lookup(key):
+            offset = key - lo
+            if offset < 0:
+                return 0
+            page = offset >> shift
+            slot = offset & ((1 << shift) - 1)
+            if page >= pages or slot >= page_len[page]:
+                return 0
+            return slots[page_base[page] + slot]
+    
+    expected = {key: name for key, name in yaml_entries}
+    for key in range(0x10000):
+        pos = lookup(key)
+        if key in expected:
+            if pos == 0:
+                errors.append(f"{header_file.name}: 0x{key:04X} missing from index")
+            elif entries[pos - 1][0] != key or entries[pos - 1][1] != expected[key]:
+                errors.append(f"{header_file.name}: 0x{key:04X} resolves to {entries[pos - 1]}")
+        elif pos != 0:
+            errors.append(f"{header_file.name}: unassigned 0x{key:04X} resolves to {entries[pos - 1]}")
+    
+    if not errors:
+        print(f"Verified {header_file.name}: {len(expected)} entries, all 65536 keys O(1)")
+    return errors
+
+def self_check(script_dir):
+    """Verify all generated headers against the YAML sources."""
+    checks = [
+        ('company_identifiers.yaml', 'bt_company_identifiers.h', 'BT_COMPANIES',
+         lambda y: load_yaml_entries(y, 'company_identifiers', 'value')),
+        ('service_uuids.yaml', 'bt_service_uuids.h', 'BT_SERVICES',
+         lambda y: load_yaml_entries(y, 'uuids', 'uuid')),
+        ('appearance_values.yaml', 'bt_appearance_values.h', 'BT_APPEARANCES',
+         load_yaml_appearances),
+        ('characteristic_uuids.yaml', 'bt_characteristic_uuids.h', 'BT_CHARACTERISTICS',
+         lambda y: load_yaml_entries(y, 'uuids', 'uuid')),
+        ('descriptor_uuids.yaml', 'bt_descriptor_uuids.h', 'BT_DESCRIPTORS',
+         lambda y: load_yaml_entries(y, 'uuids', 'uuid')),
+        ('units.yaml', 'bt_units.h', 'BT_UNITS',
+         lambda y: load_yaml_entries(y, 'uuids', 'uuid')),
+    ]
+    
+    errors = []
+    for yaml_name, header_name, prefix, loader in checks:
+        yaml_file = script_dir / yaml_name
+        header_file = script_dir / header_name
+        if yaml_file.exists() and header_file.exists():
+            errors += check_header(header_file, prefix, loader(yaml_file))
+    
+    for error in errors[:20]:
+        print(f"ERROR: {error}")
+    if errors:
+        print(f"Self-check FAILED ({len(errors)} errors)")
+        return False
+    return True
+
 def main():
     script_dir = Path(__file__).parent
     
+    if '--check' in sys.argv[1:]:
+        sys.exit(0 if self_check(script_dir) else 1)
+    
     # Convert company identifiers
     company_yaml = script_dir / 'company_identifiers.yaml'
     company_h = script_dir / 'bt_company_identifiers.h'
@@ -444,6 +650,10 @@ def main():
         print(f'  #include "{desc_h.name}"')
     if units_yaml.exists():
         print(f'  #include "{units_h.name}"')
+    
+    print()
+    if not self_check(script_dir):
+        sys.exit(1)
 
 if __name__ == '__main__':
     main()